@@ -217,6 +217,13 @@ void output_font(FONT *font, char *name)
    char buf[160];
    int c;
 
+   if (font->height == FONT_ATLAS_HEIGHT) {
+      /* the page table and atlas are built at runtime, so can't be static */
+      fprintf(stderr, "\nError: Unicode range fonts not supported (%s)\n", name);
+      err = 1;
+      return;
+   }
+
    if (font->height > 0) {
       strcpy(buf, name);
       strcat(buf, "_data");
@@ -250,6 +257,7 @@ void output_font(FONT *font, char *name)
 void output_rle_sprite(RLE_SPRITE *sprite, char *name)
 {
    int bpp = sprite->color_depth;
+   int y;
 
    if (bpp > 8)
       truecolor = TRUE;
@@ -261,8 +269,19 @@ void output_rle_sprite(RLE_SPRITE *sprite, char *name)
    fprintf(outfile, "\t.long %-16d# color depth\n", bpp);
    fprintf(outfile, "\t.long %-16d# size\n", sprite->size);
 
+   if (sprite->line_ofs)
+      fprintf(outfile, "\t.long _%s%s_line_ofs\n", prefix, name);
+   else
+      fprintf(outfile, "\t.long %-16d# no line offsets\n", 0);
+
    write_data(sprite->dat, sprite->size);
 
+   if (sprite->line_ofs) {
+      fprintf(outfile, ".align 4\n_%s%s_line_ofs:\n", prefix, name);
+      for (y=0; y<sprite->h; y++)
+	 fprintf(outfile, "\t.long %d\n", sprite->line_ofs[y]);
+   }
+
    fprintf(outfile, "\n");
 }
 
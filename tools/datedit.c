@@ -372,8 +372,17 @@ void save_datafile(DATAFILE *dat, int packed, int packkids, int strip, int verbo
 void get_font_desc(DATAFILE *dat, char *s)
 {
    FONT *font = (FONT *)dat->dat;
+   FONT_ATLAS *atlas;
+   int c, n;
 
-   if (font->height < 0)
+   if (font->height == FONT_ATLAS_HEIGHT) {
+      atlas = font->dat.dat_atlas;
+      n = 0;
+      for (c=0; c<atlas->range_count; c++)
+	 n += atlas->range[c].count;
+      sprintf(s, "Unicode font (%d ranges, %d characters)", atlas->range_count, n);
+   }
+   else if (font->height < 0)
       strcpy(s, "proportional font");
    else
       sprintf(s, "8x%d font", font->height);
@@ -381,6 +390,67 @@ void get_font_desc(DATAFILE *dat, char *s)
 
 
 
+/* export_font_ranges:
+ *  Exports a Unicode font as a grid of glyphs, sixteen to a row, running 
+ *  through each of the character ranges in turn.
+ */
+static int export_font_ranges(FONT_ATLAS *atlas, char *filename)
+{
+   FONT_RANGE *r;
+   BITMAP *b, *glyph;
+   int w, h, gw, gh, c, i, n;
+
+   w = 0;
+   h = 0;
+   n = 0;
+
+   for (c=0; c<atlas->range_count; c++) {
+      r = atlas->range+c;
+      for (i=0; i<r->count; i++)
+	 if (r->dat[r->offset[i]] > w)
+	    w = r->dat[r->offset[i]];
+      if (r->height > h)
+	 h = r->height;
+      n += r->count;
+   }
+
+   w = (w+16) & 0xFFF0;
+   h = (h+16) & 0xFFF0;
+
+   glyph = create_bitmap_ex(8, 255, 255);
+   b = create_bitmap_ex(8, 1+w*16, 1+h*((n+15)/16));
+
+   if ((!glyph) || (!b)) {
+      if (glyph)
+	 destroy_bitmap(glyph);
+      if (b)
+	 destroy_bitmap(b);
+      errno = ENOMEM;
+      return FALSE;
+   }
+
+   rectfill(b, 0, 0, b->w, b->h, 255);
+   n = 0;
+
+   for (c=0; c<atlas->range_count; c++) {
+      r = atlas->range+c;
+      for (i=0; i<r->count; i++) {
+	 _unpack_font_glyph(r, i, glyph, &gw, &gh);
+	 rectfill(b, 1+w*(n&15), 1+h*(n/16), w*(n&15)+gw, h*(n/16)+gh, 0);
+	 blit(glyph, b, 0, 0, 1+w*(n&15), 1+h*(n/16), gw, gh);
+	 n++;
+      }
+   }
+
+   save_bitmap(filename, b, desktop_pallete);
+   destroy_bitmap(b);
+   destroy_bitmap(glyph);
+
+   return (errno == 0);
+}
+
+
+
 int export_font(DATAFILE *dat, char *filename)
 {
    FONT *font = (FONT *)dat->dat;
@@ -389,6 +459,9 @@ int export_font(DATAFILE *dat, char *filename)
    char buf[2];
    int w, h, c;
 
+   if (font->height == FONT_ATLAS_HEIGHT)
+      return export_font_ranges(font->dat.dat_atlas, filename);
+
    w = 0;
    h = 0;
 
@@ -852,6 +925,47 @@ void *grab_font(char *filename, GRAB_UNUSED)
 
 
 
+/* save_font_ranges:
+ *  Writes out the character ranges of a Unicode font, in the format 
+ *  expected by load_font_object().
+ */
+static void save_font_ranges(FONT_ATLAS *atlas, PACKFILE *f)
+{
+   FONT_RANGE *r;
+   BITMAP *bmp;
+   int c, i, x, y, w, h;
+
+   bmp = create_bitmap_ex(8, 255, 255);
+   if (!bmp) {
+      errno = ENOMEM;
+      return;
+   }
+
+   pack_mputw(atlas->range_count, f);
+
+   for (c=0; c<atlas->range_count; c++) {
+      r = atlas->range+c;
+
+      pack_mputl(r->first, f);
+      pack_mputl(r->count, f);
+
+      for (i=0; i<r->count; i++) {
+	 _unpack_font_glyph(r, i, bmp, &w, &h);
+
+	 pack_mputw(w, f);
+	 pack_mputw(h, f);
+
+	 for (y=0; y<h; y++)
+	    for (x=0; x<w; x++)
+	       pack_putc(bmp->line[y][x], f);
+      }
+   }
+
+   destroy_bitmap(bmp);
+}
+
+
+
 void save_font(DATAFILE *dat, SAVE_UNUSED, PACKFILE *f)
 {
    FONT *font = (FONT *)dat->dat;
@@ -866,6 +980,9 @@ void save_font(DATAFILE *dat, SAVE_UNUSED, PACKFILE *f)
       else
 	 pack_fwrite(font->dat.dat_8x16, sizeof(FONT_8x16), f);
    }
+   else if (font->height == FONT_ATLAS_HEIGHT) {
+      save_font_ranges(font->dat.dat_atlas, f);
+   }
    else {
       for (c=0; c<FONT_SIZE; c++) {
 	 bmp = font->dat.dat_prop->dat[c];